@@ -0,0 +1,164 @@
+// Compares the compile-time specialised boards against the generic
+// runtime-sized board, for raw makeMove throughput and for bot search.
+
+#include "game.h"
+#include "bot.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Each measurement is repeated this many times, alternating which path runs
+// first, and the fastest round is reported for both paths.
+const int kRounds = 5;
+
+struct Move {
+    int r, c, player;
+};
+
+using Script = std::vector<Move>;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Records random two-player games until someone wins (or the move cap is hit).
+// The cap keeps random play away from crowded late-game boards, where a chain
+// reaction that has already eliminated the opponent can cycle without settling.
+std::vector<Script> recordScripts(int rows, int cols, int games) {
+    const int moveCap = rows * cols;
+    std::mt19937 gen(12345);
+    std::vector<Script> scripts(games);
+
+    for (Script& script : scripts) {
+        ChainReactionGame game(2, 0, rows, cols, false);
+        int player = 0;
+        for (int m = 0; m < moveCap && game.getWinner() == -1; ++m) {
+            std::vector<std::pair<int, int>> validMoves = game.getValidMoves(player);
+            if (validMoves.empty()) break;
+
+            std::uniform_int_distribution<int> distrib(0, static_cast<int>(validMoves.size()) - 1);
+            const auto& move = validMoves[distrib(gen)];
+            game.makeMove(move.first, move.second, player);
+            script.push_back({move.first, move.second, player});
+            player = 1 - player;
+        }
+    }
+    return scripts;
+}
+
+// Replays the scripts on freshly built games; only the makeMove calls are timed.
+double replayScripts(int rows, int cols, bool specialised, const std::vector<Script>& scripts,
+                     std::string* finalStates) {
+    std::vector<ChainReactionGame> games;
+    games.reserve(scripts.size());
+    for (size_t i = 0; i < scripts.size(); ++i) games.emplace_back(2, 0, rows, cols, specialised);
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < scripts.size(); ++i) {
+        ChainReactionGame& game = games[i];
+        for (const Move& move : scripts[i]) game.makeMove(move.r, move.c, move.player);
+    }
+    double millis = elapsedMs(start);
+
+    if (finalStates != nullptr) {
+        finalStates->clear();
+        for (ChainReactionGame& game : games) *finalStates += game.getGridState() + "#";
+    }
+    return millis;
+}
+
+// Builds a deterministic mid-game position to search from.
+ChainReactionGame midGamePosition(int rows, int cols, bool specialised) {
+    ChainReactionGame game(2, 0, rows, cols, specialised);
+    std::mt19937 gen(777);
+    int player = 0;
+    for (int m = 0; m < rows * cols && game.getWinner() == -1; ++m) {
+        std::uniform_int_distribution<int> rd(0, rows - 1), cd(0, cols - 1);
+        for (int tries = 0; tries < 64; ++tries) {
+            int r = rd(gen), c = cd(gen);
+            if (game.makeMove(r, c, player)) break;
+        }
+        player = 1 - player;
+    }
+    return game;
+}
+
+double runSearch(IBotStrategy& bot, const ChainReactionGame& position, int iterations,
+                 std::pair<int, int>& lastMove) {
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i) lastMove = bot.findMove(position, 0);
+    return elapsedMs(start);
+}
+
+// Runs 'measure(specialised)' for both paths over kRounds, alternating order.
+template <class Measure>
+std::pair<double, double> bestOfRounds(Measure measure) {
+    double generic = std::numeric_limits<double>::max();
+    double fixed = std::numeric_limits<double>::max();
+    for (int round = 0; round < kRounds; ++round) {
+        if (round % 2 == 0) {
+            generic = std::min(generic, measure(false));
+            fixed = std::min(fixed, measure(true));
+        } else {
+            fixed = std::min(fixed, measure(true));
+            generic = std::min(generic, measure(false));
+        }
+    }
+    return {generic, fixed};
+}
+
+void report(const char* label, std::pair<double, double> times, const char* check) {
+    std::printf("%-10s generic %9.2f ms  specialised %9.2f ms  speedup %.2fx  (%s)\n",
+                label, times.first, times.second, times.first / times.second, check);
+}
+
+void benchBoard(int rows, int cols) {
+    const int games = 2000;
+    const int greedyIters = 2000;
+    const int minimaxIters = 3;
+
+    std::printf("\n== %dx%d board ==\n", rows, cols);
+
+    std::vector<Script> scripts = recordScripts(rows, cols, games);
+    std::string genericStates, fixedStates;
+    auto moveTimes = bestOfRounds([&](bool specialised) {
+        return replayScripts(rows, cols, specialised, scripts,
+                             specialised ? &fixedStates : &genericStates);
+    });
+    report("makeMove", moveTimes, genericStates == fixedStates ? "states match" : "STATE MISMATCH");
+
+    ChainReactionGame genericPos = midGamePosition(rows, cols, false);
+    ChainReactionGame fixedPos = midGamePosition(rows, cols, true);
+    std::pair<int, int> gMove, fMove;
+
+    GreedyBot greedy;
+    auto greedyTimes = bestOfRounds([&](bool specialised) {
+        return specialised ? runSearch(greedy, fixedPos, greedyIters, fMove)
+                           : runSearch(greedy, genericPos, greedyIters, gMove);
+    });
+    report("greedy", greedyTimes, gMove == fMove ? "moves match" : "MOVE MISMATCH");
+
+    MinimaxBot minimax;
+    auto minimaxTimes = bestOfRounds([&](bool specialised) {
+        return specialised ? runSearch(minimax, fixedPos, minimaxIters, fMove)
+                           : runSearch(minimax, genericPos, minimaxIters, gMove);
+    });
+    report("minimax", minimaxTimes, gMove == fMove ? "moves match" : "MOVE MISMATCH");
+}
+
+} // namespace
+
+int main() {
+    benchBoard(12, 6);
+    benchBoard(8, 8);
+    benchBoard(10, 10);
+    return 0;
+}
@@ -0,0 +1,171 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Represents a single cell on the grid
+struct Cell {
+    int owner;
+    int orbs;
+};
+
+// Orthogonal neighbours of a cell, stored in the order the engine visits
+// them (up, down, left, right) so animation events come out the same way.
+// The compact uint8_t form backs the compile-time tables; runtime boards use int.
+template <class Coord>
+struct BasicNeighbourList {
+    int count;
+    Coord row[4];
+    Coord col[4];
+};
+
+using NeighbourList = BasicNeighbourList<std::uint8_t>;
+
+// --- Board geometry (shared by the compile-time tables and the runtime board) ---
+constexpr int cellCapacity(int r, int c, int rows, int cols) {
+    bool rowEdge = (r == 0 || r == rows - 1);
+    bool colEdge = (c == 0 || c == cols - 1);
+    return (rowEdge && colEdge) ? 1 : (rowEdge || colEdge) ? 2 : 3;
+}
+
+template <class Coord = std::uint8_t>
+constexpr BasicNeighbourList<Coord> cellNeighbours(int r, int c, int rows, int cols) {
+    constexpr int dr[] = {-1, 1, 0, 0};
+    constexpr int dc[] = {0, 0, -1, 1};
+    BasicNeighbourList<Coord> n{};
+    for (int i = 0; i < 4; ++i) {
+        int nr = r + dr[i];
+        int nc = c + dc[i];
+        if (nr < 0 || nr >= rows || nc < 0 || nc >= cols) continue;
+        n.row[n.count] = static_cast<Coord>(nr);
+        n.col[n.count] = static_cast<Coord>(nc);
+        ++n.count;
+    }
+    return n;
+}
+
+template <int R, int C>
+constexpr std::array<std::uint8_t, R * C> buildCapacityTable() {
+    std::array<std::uint8_t, R * C> caps{};
+    for (int r = 0; r < R; ++r)
+        for (int c = 0; c < C; ++c)
+            caps[r * C + c] = static_cast<std::uint8_t>(cellCapacity(r, c, R, C));
+    return caps;
+}
+
+template <int R, int C>
+constexpr std::array<NeighbourList, R * C> buildNeighbourTable() {
+    std::array<NeighbourList, R * C> table{};
+    for (int r = 0; r < R; ++r)
+        for (int c = 0; c < C; ++c)
+            table[r * C + c] = cellNeighbours(r, c, R, C);
+    return table;
+}
+
+// A cell explodes into exactly (capacity + 1) neighbours; the engine relies on it.
+template <std::size_t N>
+constexpr bool spillsMatchCapacity(const std::array<std::uint8_t, N>& caps,
+                                   const std::array<NeighbourList, N>& neighbours) {
+    for (std::size_t i = 0; i < N; ++i)
+        if (caps[i] + 1 != neighbours[i].count) return false;
+    return true;
+}
+
+/**
+ * Compile-time lookup tables for an R x C board.
+ * Capacities and neighbour lists are computed once by the compiler, so the
+ * specialised boards never do bounds checks or edge classification.
+ */
+template <int R, int C>
+struct BoardTables {
+    static_assert(R > 1 && C > 1, "board must be at least 2x2");
+    static_assert(R <= 255 && C <= 255, "coordinates are stored as uint8_t");
+    static_assert(R * C <= 65535, "cell indices are stored as uint16_t");
+
+    static constexpr int kCells = R * C;
+    static constexpr std::array<std::uint8_t, kCells> capacity = buildCapacityTable<R, C>();
+    static constexpr std::array<NeighbourList, kCells> neighbours = buildNeighbourTable<R, C>();
+
+    static_assert(spillsMatchCapacity(capacity, neighbours), "capacity and neighbour tables disagree");
+};
+
+/**
+ * Board policies. Both expose the same interface (flat cell storage, bounds,
+ * capacity, neighbours and scratch buffers for the chain reaction), so the
+ * engine core in game.cpp is written once and instantiated per board type.
+ */
+
+// Fixed-size board: dimensions and lookups are compile-time constants and the
+// cells live inline, so copying a game for bot search does not allocate.
+template <int R, int C>
+struct FixedBoard {
+    using Tables = BoardTables<R, C>;
+    using IndexQueue = std::array<std::uint16_t, Tables::kCells>;
+    using QueueFlags = std::array<char, Tables::kCells>;
+
+    std::array<Cell, Tables::kCells> cells;
+
+    FixedBoard() { cells.fill({-1, 0}); }
+
+    static constexpr int rows() { return R; }
+    static constexpr int cols() { return C; }
+    static constexpr int size() { return Tables::kCells; }
+    static constexpr int index(int r, int c) { return r * C + c; }
+    static constexpr bool inBounds(int r, int c) {
+        return static_cast<unsigned>(r) < static_cast<unsigned>(R) &&
+               static_cast<unsigned>(c) < static_cast<unsigned>(C);
+    }
+    static constexpr int capacity(int idx) { return Tables::capacity[idx]; }
+    static constexpr const NeighbourList& neighbours(int idx) { return Tables::neighbours[idx]; }
+
+    static IndexQueue makeIndexQueue() { return IndexQueue(); }
+    static QueueFlags makeQueueFlags() { return QueueFlags{}; }
+};
+
+// Runtime-sized board: the fallback for any size without a specialisation.
+struct RuntimeBoard {
+    using IndexQueue = std::vector<int>;
+    using QueueFlags = std::vector<char>;
+
+    int nRows;
+    int nCols;
+    std::vector<Cell> cells;
+
+    RuntimeBoard(int r, int c) : nRows(r), nCols(c), cells(r * c, Cell{-1, 0}) {}
+
+    int rows() const { return nRows; }
+    int cols() const { return nCols; }
+    int size() const { return nRows * nCols; }
+    int index(int r, int c) const { return r * nCols + c; }
+    bool inBounds(int r, int c) const { return r >= 0 && r < nRows && c >= 0 && c < nCols; }
+    int capacity(int idx) const { return cellCapacity(idx / nCols, idx % nCols, nRows, nCols); }
+    BasicNeighbourList<int> neighbours(int idx) const {
+        return cellNeighbours<int>(idx / nCols, idx % nCols, nRows, nCols);
+    }
+
+    IndexQueue makeIndexQueue() const { return IndexQueue(size()); }
+    QueueFlags makeQueueFlags() const { return QueueFlags(size(), 0); }
+};
+
+// --- Queries shared by every board policy ---
+template <class Board>
+bool canPlaceOrb(const Board& board, int r, int c, int player) {
+    if (!board.inBounds(r, c)) return false;
+    const Cell& cell = board.cells[board.index(r, c)];
+    return cell.owner == -1 || cell.owner == player;
+}
+
+template <class Board>
+void collectValidMoves(const Board& board, int player, std::vector<std::pair<int, int>>& out) {
+    for (int r = 0; r < board.rows(); ++r) {
+        for (int c = 0; c < board.cols(); ++c) {
+            const Cell& cell = board.cells[board.index(r, c)];
+            if (cell.owner == -1 || cell.owner == player) out.emplace_back(r, c);
+        }
+    }
+}
+
+#endif //BOARD_H
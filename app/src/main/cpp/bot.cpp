@@ -7,13 +7,7 @@
 
 // Random Bot
 std::pair<int, int> RandomBot::findMove(const ChainReactionGame& gameState, int myPlayerId) {
-    std::vector<std::pair<int, int>> validMoves;
-    for (int r = 0; r < gameState.getRows(); ++r) {
-        for (int c = 0; c < gameState.getCols(); ++c) {
-            if (gameState.isMoveValid(r, c, myPlayerId))
-                validMoves.emplace_back(r, c);
-        }
-    }
+    std::vector<std::pair<int, int>> validMoves = gameState.getValidMoves(myPlayerId);
 
     if (validMoves.empty()) return {-1, -1};
 
@@ -29,14 +23,7 @@ std::pair<int, int> RandomBot::findMove(const ChainReactionGame& gameState, int
 
 // Greedy Bot
 std::pair<int, int> GreedyBot::findMove(const ChainReactionGame& gameState, int myPlayerId) {
-    std::vector<std::pair<int, int>> validMoves;
-    for (int r = 0; r < gameState.getRows(); ++r) {
-        for (int c = 0; c < gameState.getCols(); ++c) {
-            if (gameState.isMoveValid(r, c, myPlayerId)) {
-                validMoves.emplace_back(r, c);
-            }
-        }
-    }
+    std::vector<std::pair<int, int>> validMoves = gameState.getValidMoves(myPlayerId);
 
     if (validMoves.empty()) {
         return {-1, -1}; // No moves available
@@ -73,14 +60,7 @@ std::pair<int, int> GreedyBot::findMove(const ChainReactionGame& gameState, int
 // Minimax Bot
 const int SEARCH_DEPTH = 3;
 std::pair<int, int> MinimaxBot::findMove(const ChainReactionGame& gameState, int myPlayerId) {
-    std::vector<std::pair<int, int>> validMoves;
-    for (int r = 0; r < gameState.getRows(); ++r) {
-        for (int c = 0; c < gameState.getCols(); ++c) {
-            if (gameState.isMoveValid(r, c, myPlayerId)) {
-                validMoves.emplace_back(r, c);
-            }
-        }
-    }
+    std::vector<std::pair<int, int>> validMoves = gameState.getValidMoves(myPlayerId);
 
     if (validMoves.empty()) return {-1, -1};
     if (validMoves.size() == 1) return validMoves[0];
@@ -128,10 +108,8 @@ int MinimaxBot::minimax(ChainReactionGame gameState, int depth, int alpha, int b
 
     if (isMaximizingPlayer) { // The Bot's turn (MAXIMIZE score)
         int maxEval = std::numeric_limits<int>::min();
-        std::vector<std::pair<int, int>> validMoves;
         // Find all of my valid moves...
-        for (int r = 0; r < gameState.getRows(); ++r) for (int c = 0; c < gameState.getCols(); ++c)
-                if (gameState.isMoveValid(r, c, myPlayerId)) validMoves.emplace_back(r, c);
+        std::vector<std::pair<int, int>> validMoves = gameState.getValidMoves(myPlayerId);
 
         for (const auto& move : validMoves) {
             ChainReactionGame childState = gameState;
@@ -149,10 +127,8 @@ int MinimaxBot::minimax(ChainReactionGame gameState, int depth, int alpha, int b
     } else { // The Opponent's turn (MINIMIZE score)
         int minEval = std::numeric_limits<int>::max();
         int opponentId = 1 - myPlayerId;
-        std::vector<std::pair<int, int>> validMoves;
         // Find all of opponent's valid moves...
-        for (int r = 0; r < gameState.getRows(); ++r) for (int c = 0; c < gameState.getCols(); ++c)
-                if (gameState.isMoveValid(r, c, opponentId)) validMoves.emplace_back(r, c);
+        std::vector<std::pair<int, int>> validMoves = gameState.getValidMoves(opponentId);
 
         if (validMoves.empty()) {
             return gameState.getPlayerScore(myPlayerId) - gameState.getPlayerScore(opponentId);
@@ -1,18 +1,21 @@
 #include "game.h"
-#include <queue>
 #include <sstream>
 #include <algorithm>
-#include <android/log.h>
+#include <utility>
 
+#ifdef __ANDROID__
+#include <android/log.h>
 #define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, "ChainReaction", __VA_ARGS__)
+#else
+#define LOGD(...) ((void)0)
+#endif
 
 // --- ChainReactionGame Implementation ---
-ChainReactionGame::ChainReactionGame(int pCount, int botType, int r, int c) : rows(r), cols(c) {
+ChainReactionGame::ChainReactionGame(int pCount, int botType, int r, int c, bool specialised)
+        : rows(r), cols(c), board(makeBoard(r, c, specialised)) {
     this->playerCount = pCount;
     this->movesMade = 0;
 
-    this->grid.assign(rows, std::vector<Cell>(cols, {-1, 0}));
-
     this->playerScores.clear();
     this->alive.clear();
     this->botStrategies.clear();
@@ -40,12 +43,11 @@ ChainReactionGame::ChainReactionGame(int pCount, int botType, int r, int c) : ro
 
 ChainReactionGame::~ChainReactionGame() {}
 
-ChainReactionGame::ChainReactionGame(const ChainReactionGame& other) {
+ChainReactionGame::ChainReactionGame(const ChainReactionGame& other) : board(other.board) {
     this->rows = other.rows;
     this->cols = other.cols;
     this->playerCount = other.playerCount;
     this->movesMade = other.movesMade;
-    this->grid = other.grid;
     this->playerScores = other.playerScores;
     this->alive = other.alive;
     this->aliveCount = other.aliveCount;
@@ -85,17 +87,40 @@ void ChainReactionGame::markDeadIfNeeded(int player) {
     }
 }
 
+// --- Board Selection ---
+// Picks the compile-time specialised board for common sizes, falling back to
+// the runtime-sized board for anything else.
+BoardVariant ChainReactionGame::makeBoard(int r, int c, bool specialised) {
+    if (specialised) {
+        if (r == 12 && c == 6)  return BoardVariant(std::in_place_type<FixedBoard<12, 6>>);
+        if (r == 9 && c == 6)   return BoardVariant(std::in_place_type<FixedBoard<9, 6>>);
+        if (r == 8 && c == 8)   return BoardVariant(std::in_place_type<FixedBoard<8, 8>>);
+        if (r == 10 && c == 10) return BoardVariant(std::in_place_type<FixedBoard<10, 10>>);
+        if (r == 15 && c == 10) return BoardVariant(std::in_place_type<FixedBoard<15, 10>>);
+    }
+    return BoardVariant(std::in_place_type<RuntimeBoard>, r, c);
+}
+
 // --- Grid Utilities ---
 std::string ChainReactionGame::getGridState() {
-    std::stringstream ss;
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            ss << grid[i][j].owner << "," << grid[i][j].orbs;
-            if (j < cols - 1) ss << ";";
+    return std::visit([](const auto& grid) {
+        std::stringstream ss;
+        for (int i = 0; i < grid.rows(); ++i) {
+            for (int j = 0; j < grid.cols(); ++j) {
+                const Cell& cell = grid.cells[grid.index(i, j)];
+                ss << cell.owner << "," << cell.orbs;
+                if (j < grid.cols() - 1) ss << ";";
+            }
+            if (i < grid.rows() - 1) ss << "|";
         }
-        if (i < rows - 1) ss << "|";
-    }
-    return ss.str();
+        return ss.str();
+    }, board);
+}
+
+const Cell& ChainReactionGame::getCell(int r, int c) const {
+    return std::visit([r, c](const auto& grid) -> const Cell& {
+        return grid.cells[grid.index(r, c)];
+    }, board);
 }
 
 int ChainReactionGame::getPlayerScore(int player) const {
@@ -103,38 +128,16 @@ int ChainReactionGame::getPlayerScore(int player) const {
     return playerScores[player];
 }
 
-int ChainReactionGame::getCellCapacity(int r, int c) const {
-    if ((r == 0 || r == rows - 1) && (c == 0 || c == cols - 1)) return 1;
-    if (r == 0 || r == rows - 1 || c == 0 || c == cols - 1) return 2;
-    return 3;
-}
-
 // --- Move Validation ---
 bool ChainReactionGame::isMoveValid(int r, int c, int player) const {
-    if (r < 0 || r >= rows || c < 0 || c >= cols) return false;
-    const Cell& cell = grid[r][c];
-    return cell.owner == -1 || cell.owner == player;
+    return std::visit([&](const auto& grid) { return canPlaceOrb(grid, r, c, player); }, board);
 }
 
-// --- Move Execution ---
-bool ChainReactionGame::makeMove(int r, int c, int player) {
-    if (!isMoveValid(r, c, player)) return false;
-
-    lastAnimationEvents.clear();
-
-    Cell& cell = grid[r][c];
-    cell.owner = player;
-    cell.orbs++;
-
-    adjustPlayerScore(player, 1); // increment player score & update alive
-
-    std::queue<std::pair<int, int>> unstableCells;
-    if (cell.orbs > getCellCapacity(r, c)) unstableCells.emplace(r, c);
-
-    if (!unstableCells.empty()) processChainReaction(unstableCells);
-
-    movesMade++;
-    return true;
+std::vector<std::pair<int, int>> ChainReactionGame::getValidMoves(int player) const {
+    std::vector<std::pair<int, int>> moves;
+    moves.reserve(rows * cols);
+    std::visit([&](const auto& grid) { collectValidMoves(grid, player, moves); }, board);
+    return moves;
 }
 
 // --- Clamp player scores (safety) ---
@@ -153,38 +156,76 @@ void ChainReactionGame::clampPlayerScores() {
     }
 }
 
-// --- Chain Reaction Processing ---
-void ChainReactionGame::processChainReaction(std::queue<std::pair<int, int>>& q) {
-    const int dr[] = {-1, 1, 0, 0};
-    const int dc[] = {0, 0, -1, 1};
-    std::vector<char> inQueue(rows * cols, 0);
-
-    std::queue<std::pair<int,int>> temp = q;
-    while (!temp.empty()) { inQueue[flatIndex(temp.front().first, temp.front().second)] = 1; temp.pop(); }
+// --- Engine Core ---
+// Written once against the board policy interface in board.h. Fixed boards
+// resolve capacities and neighbours from constexpr tables; the runtime board
+// computes them on the fly.
+template <class Board>
+bool ChainReactionGame::makeMoveOn(Board& grid, int r, int c, int player) {
+    if (!canPlaceOrb(grid, r, c, player)) return false;
 
-    while (!q.empty()) {
-        auto pos = q.front(); q.pop();
-        int r = pos.first;
-        int c = pos.second;
-        inQueue[flatIndex(r,c)] = 0;
-
-        if (grid[r][c].owner == -1 || grid[r][c].orbs <= getCellCapacity(r, c)) continue;
+    lastAnimationEvents.clear();
 
-        Cell explodingCell = grid[r][c];
-        int owner = explodingCell.owner;
-        int orbsInCell = explodingCell.orbs;
+    int idx = grid.index(r, c);
+    Cell& cell = grid.cells[idx];
+    cell.owner = player;
+    cell.orbs++;
 
-        adjustPlayerScore(owner, -orbsInCell); // owner loses exploding orbs
-        grid[r][c] = {-1, 0};
+    adjustPlayerScore(player, 1); // increment player score & update alive
 
-        for (int i = 0; i < 4; ++i) {
-            int nr = r + dr[i];
-            int nc = c + dc[i];
-            if (nr < 0 || nr >= rows || nc < 0 || nc >= cols) continue;
+    if (cell.orbs > grid.capacity(idx)) processChainReaction(grid, r, c);
 
-            lastAnimationEvents.push_back({r, c, nr, nc, owner});
+    movesMade++;
+    return true;
+}
 
-            Cell &neighbor = grid[nr][nc];
+// --- Chain Reaction Processing ---
+template <class Board>
+void ChainReactionGame::processChainReaction(Board& grid, int r, int c) {
+    // Every cell is queued at most once at a time, so a ring of size() slots never overflows.
+    typename Board::IndexQueue ring = grid.makeIndexQueue();
+    typename Board::QueueFlags inQueue = grid.makeQueueFlags();
+    using QueueIndex = typename Board::IndexQueue::value_type;
+    const int slots = grid.size();
+    int head = 0;
+    int queued = 0;
+
+    auto push = [&](int idx) {
+        int tail = head + queued;
+        if (tail >= slots) tail -= slots;
+        ring[tail] = static_cast<QueueIndex>(idx);
+        ++queued;
+        inQueue[idx] = 1;
+    };
+
+    push(grid.index(r, c));
+
+    while (queued > 0) {
+        int idx = ring[head];
+        if (++head == slots) head = 0;
+        --queued;
+        inQueue[idx] = 0;
+
+        Cell& exploding = grid.cells[idx];
+        if (exploding.owner == -1 || exploding.orbs <= grid.capacity(idx)) continue;
+
+        int er = idx / grid.cols();
+        int ec = idx % grid.cols();
+        int owner = exploding.owner;
+
+        adjustPlayerScore(owner, -exploding.orbs); // owner loses exploding orbs
+        exploding = {-1, 0};
+
+        const auto& adj = grid.neighbours(idx);
+
+        auto spill = [&](int i) {
+            int nr = adj.row[i];
+            int nc = adj.col[i];
+
+            lastAnimationEvents.push_back({er, ec, nr, nc, owner});
+
+            int nIdx = grid.index(nr, nc);
+            Cell& neighbor = grid.cells[nIdx];
             int prevOwner = neighbor.owner;
             int prevOrbs  = neighbor.orbs;
 
@@ -202,17 +243,26 @@ void ChainReactionGame::processChainReaction(std::queue<std::pair<int, int>>& q)
                 adjustPlayerScore(prevOwner, -prevOrbs);
             }
 
-            int idx = flatIndex(nr, nc);
-            if (neighbor.orbs > getCellCapacity(nr, nc) && !inQueue[idx]) {
-                q.emplace(nr, nc);
-                inQueue[idx] = 1;
-            }
+            if (neighbor.orbs > grid.capacity(nIdx) && !inQueue[nIdx]) push(nIdx);
+        };
+
+        // Unrolled per neighbour count: corners have 2, edges 3, interior cells 4.
+        switch (adj.count) {
+            case 4: spill(0); spill(1); spill(2); spill(3); break;
+            case 3: spill(0); spill(1); spill(2); break;
+            case 2: spill(0); spill(1); break;
+            case 1: spill(0); break; // single-row or single-column runtime boards
         }
     }
 
     clampPlayerScores(); // final safety
 }
 
+// --- Move Execution ---
+bool ChainReactionGame::makeMove(int r, int c, int player) {
+    return std::visit([&](auto& grid) { return makeMoveOn(grid, r, c, player); }, board);
+}
+
 // --- Winner & Eliminated ---
 int ChainReactionGame::getWinner() {
     if (movesMade < playerCount) return -1;
@@ -2,19 +2,14 @@
 #define GAME_H
 
 #include <vector>
-#include <queue>
 #include <string>
 #include <utility>
 #include <map>
 #include <memory>
+#include <variant>
+#include "board.h"
 #include "bot.h"
 
-// Represents a single cell on the grid
-struct Cell {
-    int owner;
-    int orbs;
-};
-
 // Represents an orb moving from one cell to another for animation
 struct OrbAnimationEvent {
     int fromRow, fromCol;
@@ -22,11 +17,23 @@ struct OrbAnimationEvent {
     int playerOwner;
 };
 
+// Board storage: the runtime-sized fallback plus fixed-size specialisations
+// for common sizes (GameViewModel always asks for 12x6).
+using BoardVariant = std::variant<
+        RuntimeBoard,
+        FixedBoard<12, 6>,
+        FixedBoard<9, 6>,
+        FixedBoard<8, 8>,
+        FixedBoard<10, 10>,
+        FixedBoard<15, 10>>;
+
 // The main game engine class.
 class ChainReactionGame {
 public:
     // --- Constructor & Destructor ---
-    ChainReactionGame(int pCount, int botType, int r, int c);
+    // Boards with a compile-time specialisation (see makeBoard) use it unless
+    // 'specialised' is false, which forces the generic runtime-sized board.
+    ChainReactionGame(int pCount, int botType, int r, int c, bool specialised = true);
     ~ChainReactionGame();
 
     // --- Core Lifecycle Methods ---
@@ -43,6 +50,7 @@ public:
     std::string getGridState();
     const std::vector<OrbAnimationEvent> getLastAnimationEvents();
     bool isMoveValid(int r, int c, int player) const;
+    std::vector<std::pair<int, int>> getValidMoves(int player) const;
     bool isPlayerBot(int player) const;
     std::pair<int, int> getBotMove(int player);
 
@@ -50,21 +58,23 @@ public:
     // --- Public Getters for Bot Simulation ---
     int getRows() const { return rows; }
     int getCols() const { return cols; }
-    const std::vector<std::vector<Cell>>& getGrid() const { return grid; }
+    const Cell& getCell(int r, int c) const;
 
 private:
     // --- Private Helper Methods ---
-    int getCellCapacity(int r, int c) const;
-    void processChainReaction(std::queue<std::pair<int, int>>& q);
+    static BoardVariant makeBoard(int r, int c, bool specialised);
     void clampPlayerScores();
 
+    // --- Engine core, instantiated once per board policy (see board.h) ---
+    template <class Board> bool makeMoveOn(Board& grid, int r, int c, int player);
+    template <class Board> void processChainReaction(Board& grid, int r, int c);
+
     // bookkeeping for fast winner check
     std::vector<char> alive;
     int aliveCount = 0;
     int lastAlivePlayer = -1;
     void markAliveIfNeeded(int player);
     void markDeadIfNeeded(int player);
-    inline int flatIndex(int r, int c) const { return r * cols + c; }
     inline void adjustPlayerScore(int player, int delta);
 
     // --- Game State Members ---
@@ -72,7 +82,7 @@ private:
     int cols;
     int playerCount;
     int movesMade;
-    std::vector<std::vector<Cell>> grid;
+    BoardVariant board;
     std::vector<int> playerScores;
 //    std::unordered_map<int, int> playerScores;
     std::vector<OrbAnimationEvent> lastAnimationEvents;